@@ -0,0 +1,38 @@
+//list of jobs waiting to be run by one of the batch threads
+struct WorkQueue
+{
+   std::mutex lock;
+   std::deque<int32_t> jobs;   //indices into the list of files
+};
+
+//results of a job in the batch
+#define BFAILED 0     //output differs from the .idump file
+#define BPASSED 1     //output matches the .idump file
+#define BNOREF 2      //there is no .idump file to compare to
+
+//Runs the .yo files named in a list file on several threads. Each
+//file is simulated by its own Simulate object and its output is
+//compared to the .idump file with the same name. The files are dealt
+//out to the threads' queues and a thread that runs out of work steals
+//jobs from the other queues.
+class Batch
+{
+   private:
+      bool loaded;                      //true if the list file was read
+      std::vector<std::string> files;   //.yo files in the batch
+      std::vector<int32_t> results;     //BFAILED, BPASSED or BNOREF
+      WorkQueue * queues;               //one queue per thread
+      int32_t numThreads;
+      int32_t mode;                     //output mode for Simulate
+      uint64_t interval;                //dump interval for Simulate
+      uint64_t memSize;                 //memory size for Simulate
+      bool nextJob(int32_t thread, int32_t & job);
+      void worker(int32_t thread);
+      void runJob(int32_t job);
+   public:
+      Batch(char * listFile, int32_t numThreads, int32_t mode,
+            uint64_t interval, uint64_t memSize);
+      ~Batch();
+      bool isLoaded();
+      int32_t run(std::ostream & out);
+};
@@ -0,0 +1,100 @@
+class FetchStage;
+class DecodeCache;
+struct Predecoded;
+
+//number of entries in the block cache (must be a power of 2)
+#define BLOCKCACHESIZE 0x400
+//longest block; a longer run of straight line code is split
+#define MAXBLOCKOPS 32
+//words of memory below this address are marked in a table rather than
+//a hash set
+#define CODETABLESIZE 0x100000
+
+//register an operation writes when the instruction names RNONE; it is
+//never read, so RNONE reads as 0
+#define RDISCARD 16
+
+//kinds of operations; the condition of a jXX or cmovXX is part of its
+//kind so that it doesn't have to be decoded when it is executed
+#define OPNOP 0
+#define OPRRMOVQ 1
+#define OPCMOVLE 2
+#define OPCMOVL 3
+#define OPCMOVE 4
+#define OPCMOVNE 5
+#define OPCMOVGE 6
+#define OPCMOVG 7
+#define OPIRMOVQ 8
+#define OPRMMOVQ 9
+#define OPMRMOVQ 10
+#define OPADDQ 11
+#define OPSUBQ 12
+#define OPANDQ 13
+#define OPXORQ 14
+#define OPJMP 15
+#define OPJLE 16
+#define OPJL 17
+#define OPJE 18
+#define OPJNE 19
+#define OPJGE 20
+#define OPJG 21
+#define OPJNEVER 22      //jXX with an ifun that is never true
+#define OPCALL 23
+#define OPRET 24
+#define OPPUSHQ 25
+#define OPPOPQ 26
+#define OPSTOP 27        //halt or an instruction that can't be fetched;
+                         //valC holds its stat
+
+//one instruction translated for Functional: the fields it uses are
+//decoded into the registers it reads (a, b) and writes (d)
+struct Op
+{
+   uint8_t kind;
+   uint8_t a;        //register read for valA (RNONE reads 0)
+   uint8_t b;        //register read for valB
+   uint8_t d;        //register written (RDISCARD if none)
+   uint64_t valC;
+   uint64_t pc;      //address of the instruction
+   uint64_t valP;    //address of the next instruction
+};
+
+//straight line code that starts at pc and ends with a jXX, call, ret,
+//halt or an instruction that can't be fetched (or after MAXBLOCKOPS
+//instructions)
+struct Block
+{
+   bool valid;
+   uint64_t pc;
+   uint64_t end;           //address after the last byte of the block
+   uint64_t size;          //number of ops
+   Op ops[MAXBLOCKOPS];
+};
+
+//Cache of the basic blocks of a program translated for Functional.
+//A block is translated the first time it is executed and then run
+//from the cache. The 8-byte words of memory that hold translated code
+//are marked; a store to a marked word must call invalidate so that the
+//blocks that overlap it are translated again. Each line of memory
+//keeps the entries of the blocks that were translated from it, so that
+//invalidate only looks at those blocks.
+class BlockCache
+{
+   private:
+      FetchStage * fetch;     //used to decode instructions not yet cached
+      DecodeCache * icache;   //instructions that have been predecoded
+      Block * table[BLOCKCACHESIZE];   //NULL until a block is put there
+      uint8_t * words;        //code marks for words below CODETABLESIZE
+      std::unordered_set<uint64_t> highWords;   //marks for the rest
+      //entries of table that hold (or held) a block of each line
+      std::unordered_map<uint64_t, std::vector<uint32_t>> owners;
+      void translate(Op * op, Predecoded * instr, uint64_t pc);
+      void mark(uint64_t first, uint64_t end, uint32_t entry);
+   public:
+      BlockCache(FetchStage * fetch, DecodeCache * icache);
+      ~BlockCache();
+      Block * lookup(uint64_t pc);
+      Block * insert(uint64_t pc);
+      bool isCode(uint64_t address);
+      bool invalidate(uint64_t address, uint64_t size);
+};
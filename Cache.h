@@ -0,0 +1,72 @@
+//replacement policies
+#define LRU 0
+#define FIFO 1
+#define RANDOM 2
+
+//one line of a cache; only the tags are kept since the data is
+//always read from and written to the Memory
+struct CacheLine
+{
+   bool valid;
+   uint64_t tag;       //address of the line divided by the line size
+   uint64_t stamp;     //time of the last use (LRU) or of the fill (FIFO)
+};
+
+//what a cache holds and is waiting for, as it is saved in a checkpoint
+//(the lines are saved after it); size is 0 if there is no cache
+struct CacheState
+{
+   uint64_t size;
+   uint64_t assoc;
+   uint64_t lineSize;
+   uint64_t policy;
+   uint64_t latency;
+   uint64_t time;
+   uint64_t seed;
+   uint64_t wait;
+   uint64_t filled;
+   uint64_t fillAddress;
+};
+
+//Timing model of a set associative L1 cache in front of the Memory.
+//access says whether the bytes being read or written are in the
+//cache and brings them in if they aren't. The stage that uses the
+//cache calls ready every cycle; after a miss it returns false for
+//the latency of the cache and then true without making the access
+//again, since the fill has already brought the bytes in. Writes
+//allocate a line like reads do.
+class Cache
+{
+   private:
+      uint64_t size;        //bytes of data held
+      uint64_t assoc;       //lines per set
+      uint64_t lineSize;    //bytes per line
+      uint64_t numSets;
+      int32_t policy;       //LRU, FIFO or RANDOM
+      uint64_t latency;     //cycles a miss takes
+      CacheLine * lines;    //numSets sets of assoc lines
+      uint64_t time;        //number of accesses made, used for the stamps
+      uint64_t seed;        //state of the generator used for RANDOM
+      uint64_t hits;
+      uint64_t misses;
+      uint64_t wait;        //cycles left until the last miss is done
+      bool filled;          //true if the last miss is done and the
+                            //access that missed hasn't been retried
+      uint64_t fillAddress; //address of the access that missed
+      bool lookup(uint64_t tag);
+   public:
+      Cache(uint64_t size, uint64_t assoc, uint64_t lineSize, int32_t policy,
+            uint64_t latency);
+      ~Cache();
+      bool access(uint64_t address, uint64_t count);
+      bool ready(uint64_t address, uint64_t count, bool needed);
+      uint64_t getLatency();
+      uint64_t getNumLines();
+      void getState(CacheState * state, CacheLine * lines);
+      bool matches(CacheState * state);
+      void setState(CacheState * state, const CacheLine * lines);
+      uint64_t getHits();
+      uint64_t getMisses();
+      void write(std::ostream & out);
+      static Cache * create(const char * spec);
+};
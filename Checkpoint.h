@@ -0,0 +1,65 @@
+//first bytes of every checkpoint file
+#define CKPTMAGIC "Y86CKPT"
+//changes whenever the layout of a checkpoint file changes
+#define CKPTVERSION 6
+
+class Memory;
+class ConditionCodes;
+class Pipeline;
+class Predictor;
+class ReturnStack;
+class Cache;
+
+//Layout of the start of a checkpoint file. It is followed by the
+//rasSize entries of the return address stack, the lines of the
+//instruction cache and of the data cache (if there are caches) and
+//then by the numPages pages of memory that have been allocated, each
+//one stored as its 64-bit address followed by its pageSize bytes.
+//Values are stored in the byte order of the machine that wrote the
+//file.
+struct CheckpointHeader
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t pageSize;
+   uint64_t memSize;                          //memory limit
+   uint64_t numPages;
+   uint64_t cycle;                            //last cycle simulated
+   uint64_t cc[3];                            //ZF, SF and OF
+   uint64_t reg[REGSIZE];
+   uint64_t input[NUMPIPEREGS][MAXFIELDS];    //pipelined register inputs
+   uint64_t state[NUMPIPEREGS][MAXFIELDS];    //pipelined register outputs
+   PipeState pipe;      //outputs with the fields that aren't dumped
+   char predictor[8];                         //name of the jump predictor
+   PredictorState predictions;                //what it has learned
+   uint64_t rasSize;                          //0 if rets aren't predicted
+   uint64_t rasTop;                           //next entry of the stack
+   uint64_t rasCount;                         //valid entries of the stack
+   CacheState l1i;                            //instruction cache
+   CacheState l1d;                            //data cache
+};
+
+//Saves and restores the complete state of a machine: memory, register
+//file, condition codes and the pipelined registers. The stages don't
+//need to be saved since they recompute everything from the pipelined
+//registers at the start of each cycle. The flat copy of the pipelined
+//registers is saved as well since it also holds the addresses and
+//predictions of the instructions in the pipeline, and so is what the
+//jump predictor and return address stack have learned and the lines
+//of the caches and the misses the stages are waiting for. A checkpoint
+//can only be restored into a machine with the same predictor, return
+//address stack size and caches.
+class Checkpoint
+{
+   public:
+      static bool save(char * file, uint64_t cycle, Memory * mem,
+                       RegisterFile * reg, ConditionCodes * cc,
+                       PipeReg ** pregs, Pipeline * pipe,
+                       Predictor * predictor, ReturnStack * ras,
+                       Cache * l1i, Cache * l1d);
+      static bool restore(char * file, uint64_t & cycle, Memory * mem,
+                          RegisterFile * reg, ConditionCodes * cc,
+                          PipeReg ** pregs, Pipeline * pipe,
+                          Predictor * predictor, ReturnStack * ras,
+                       Cache * l1i, Cache * l1d);
+};
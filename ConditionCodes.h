@@ -7,13 +7,14 @@
 class ConditionCodes 
 {
    private:
-      static ConditionCodes * ccInstance;
-      ConditionCodes();
       uint64_t codes;
+      bool dirty;    //true if codes changed since clearDirty
    public:
-      static ConditionCodes * getInstance();      
+      ConditionCodes();
       bool getConditionCode(int32_t ccNum, bool & error);
       void setConditionCode(bool value, int32_t ccNum, 
                             bool & error);
-      void dump();
+      void dump(std::ostream & out);
+      bool isDirty();
+      void clearDirty();
 }; 
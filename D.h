@@ -18,5 +18,5 @@ class D : public PipeReg
       PipeRegField * getrB();
       PipeRegField * getvalC();
       PipeRegField * getvalP();
-      void dump();
+      void dump(std::ostream & out);
 };
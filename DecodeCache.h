@@ -0,0 +1,33 @@
+//number of entries in the predecode cache (must be a power of 2)
+#define DCACHESIZE 0x1000
+
+//an instruction after it has been fetched and split into its fields
+struct Predecoded
+{
+   bool valid;       //false if the entry doesn't hold an instruction
+   uint64_t pc;      //address of the instruction
+   uint64_t stat;    //fetch status (SAOK, SADR, SINS or SHLT)
+   uint64_t icode;
+   uint64_t ifun;
+   uint64_t rA;
+   uint64_t rB;
+   uint64_t valC;
+   uint64_t valP;    //address of the next instruction
+};
+
+//Direct mapped cache of predecoded instructions indexed by PC. The
+//FetchStage fills it as instructions are fetched so that an instruction
+//is only read from memory and decoded the first time it is fetched.
+//Writes to memory that overlap a cached instruction must call
+//invalidate so that self-modifying code is fetched again.
+class DecodeCache
+{
+   private:
+      Predecoded entries[DCACHESIZE];
+   public:
+      DecodeCache();
+      Predecoded * lookup(uint64_t pc);
+      Predecoded * insert(uint64_t pc);
+      void invalidate(uint64_t address, uint64_t size);
+      void clear();
+};
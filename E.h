@@ -24,5 +24,5 @@ class E : public PipeReg
       PipeRegField * getdstM();
       PipeRegField * getsrcA();
       PipeRegField * getsrcB();
-      void dump();
+      void dump(std::ostream & out);
 };
@@ -6,5 +6,5 @@ class F : public PipeReg
    public:
       F();
       PipeRegField * getpredPC();
-      void dump();
+      void dump(std::ostream & out);
 };
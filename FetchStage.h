@@ -1,32 +1,56 @@
+class Memory;
+class DecodeCache;
+class Pipeline;
+class Predictor;
+class ReturnStack;
+class Cache;
+class StoreBuffer;
+struct Predecoded;
+
 //class to perform the combinational logic of
 //the Fetch stage
-class FetchStage: public Stage
+class FetchStage
 {
    private:
-      void setDInput(D * dreg, uint64_t stat, uint64_t icode, uint64_t ifun, 
+      void setDInput(DState * dreg, uint64_t stat, uint64_t icode, uint64_t ifun, 
                      uint64_t rA, uint64_t rB,
                      uint64_t valC, uint64_t valP);
-      bool F_stall;
-      bool D_stall;
-      bool D_bubble;
+      Memory * mem;
+      DecodeCache * icache;
+      Predictor * predictor;  //predicts the conditional jumps
+      ReturnStack * ras;      //predicts the rets (NULL to stall for them)
+      Cache * l1i;            //instruction cache model (NULL if none)
+      StoreBuffer * stores;   //stores of this core that the shared memory
+                              //doesn't hold yet (NULL if not shared)
+      uint8_t readByte(uint64_t address, bool & error);
    public:      
-      bool doClockLow(PipeReg ** pregs, Stage ** stages);
-      void doClockHigh(PipeReg ** pregs);
-      uint64_t selectPC(F * freg, M * mreg, W * wreg);
+      FetchStage(Memory * mem, DecodeCache * icache, Predictor * predictor,
+                 ReturnStack * ras);
+      void setPredictor(Predictor * predictor, ReturnStack * ras);
+      void setCache(Cache * l1i);
+      void setStoreBuffer(StoreBuffer * stores);
+      Predecoded * predecode(uint64_t f_pc);
+      bool doClockLow(Pipeline * pipe);
+      uint64_t selectPC(FState * freg, MState * mreg, WState * wreg,
+                        Signals * sig);
       bool needRegIds(uint64_t icode);
       bool needValC(uint64_t icode);
-      uint64_t predictPC(uint64_t icode, uint64_t valC, uint64_t valP);
+      uint64_t predictPC(uint64_t f_pc, uint64_t icode, uint64_t ifun,
+                         uint64_t valC, uint64_t valP);
+      void updateReturnStack(uint64_t icode, uint64_t valP);
+      bool waitingRet(uint64_t icode, uint64_t predPC);
+      bool fetchReady(uint64_t f_pc, uint64_t size, bool advance);
       uint64_t PCincrement(uint64_t f_pc, bool regIds, bool valC);
       uint64_t getRegIds(uint64_t f_pc);
       uint64_t buildValC(uint64_t f_pc, bool needReg);
       bool instr_valid(uint64_t icode);
       uint64_t f_stat(bool mem_error, uint64_t icode);
-      uint64_t f_icode(bool mem_error, M * mreg);
+      uint64_t f_icode(bool mem_error, MState * mreg);
       uint64_t f_ifun(bool mem_error, uint64_t ifun);
-      bool getF_stall (D * dreg, E * ereg, M * mreg, Stage ** stages);
-      bool getD_stall (E * ereg, Stage ** stages);
-      void calculateControlSignals(D * dreg, E * ereg, M * mreg, Stage ** stages);
-      bool calculateD_bubble(D * dreg, E * ereg, M * mreg, Stage ** stages);
-      void bubbleD(PipeReg ** pregs);
-      void normalD(PipeReg ** pregs);
+      bool getF_stall(Signals * sig);
+      bool getD_stall(Signals * sig);
+      void calculateControlSignals(DState * dreg, EState * ereg, MState * mreg,
+                                   Signals * sig);
+      bool calculateD_bubble(Signals * sig);
+      void bubbleD(DState * dreg);
 };
@@ -0,0 +1,41 @@
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class FetchStage;
+class DecodeCache;
+class Superscalar;
+class BlockCache;
+
+//Executes a y86-64 program one instruction at a time at the ISA level:
+//there are no pipelined registers, stalls or bubbles. It uses the same
+//memory, register file and condition codes as the PIPE stages so the
+//PIPE model can carry on from the state that it leaves behind. With
+//a BlockCache it runs the translated basic blocks of the program, one
+//after another, instead of decoding each instruction as it goes.
+class Functional
+{
+   private:
+      Memory * mem;
+      RegisterFile * reg;
+      ConditionCodes * cc;
+      FetchStage * fetch;     //used to decode instructions not yet cached
+      DecodeCache * icache;   //instructions that have been predecoded
+      uint64_t pc;            //address of the next instruction
+      uint64_t stat;          //SAOK until the program stops
+      uint64_t count;         //number of instructions executed
+      Superscalar * timing;   //times the instructions (NULL if not timed)
+      BlockCache * blocks;    //translated code (NULL to interpret)
+      bool cond(uint64_t ifun);
+      void setCC(uint64_t ifun, uint64_t valA, uint64_t valB, uint64_t valE);
+      void runBlocks(uint64_t limit);
+      bool store(uint64_t value, uint64_t address, bool & error);
+   public:
+      Functional(Memory * mem, RegisterFile * reg, ConditionCodes * cc,
+                 FetchStage * fetch, DecodeCache * icache, uint64_t pc);
+      void setTiming(Superscalar * timing);
+      void setBlocks(BlockCache * blocks);
+      void run(uint64_t limit);
+      uint64_t getPC();
+      uint64_t getStat();
+      uint64_t getCount();
+};
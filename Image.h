@@ -0,0 +1,37 @@
+//first bytes of every image file
+#define IMAGEMAGIC "Y86IMG"
+//changes whenever the layout of an image file changes
+#define IMAGEVERSION 1
+
+class Memory;
+
+//Layout of the start of a .ybin image file. It is followed by
+//numSegments segments, each one a SegmentHeader followed by its size
+//bytes. Values are stored in the byte order of the machine that wrote
+//the file.
+struct ImageHeader
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t numSegments;
+   uint64_t entry;        //address of the first instruction
+};
+
+struct SegmentHeader
+{
+   uint64_t address;      //where the first byte of the segment goes
+   uint64_t size;         //number of bytes in the segment
+};
+
+//Saves a program that has been loaded into memory as a .ybin image and
+//loads it back. The program has already been checked by the Loader when
+//the image is made, so loading it only has to check that the segments
+//fit in memory and copy them.
+class Image
+{
+   public:
+      static bool isImage(const char * buffer, uint64_t size);
+      static bool save(char * file, Memory * mem, uint64_t entry);
+      static bool load(const char * buffer, uint64_t size, Memory * mem,
+                       uint64_t & entry);
+};
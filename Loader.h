@@ -1,21 +1,23 @@
+class Memory;
+
 class Loader
 {
    private:
       bool loaded;   //set to true if a file is successfully loaded into memory
-      ifstream inFile;  //input file handle
-      bool checkYo (char* arr);
-      void loadline(std::string line);
-      int32_t convert (std:: string line, int start, int end);
-      bool checkErrors(std::string line);
-      bool checkComment(std::string line);
-      bool checkColon(std::string line);
-      bool checkPipe(std::string line);
-      //bool commentLine(string line);
-      bool checkAddress(string line);
-      bool dataSpace(string line);
-      
-      //int getDataEnd (string line);
+      Memory * mem;     //memory the program is loaded into
+      int32_t lastAddress;  //last address loaded so far
+      uint64_t entry;       //address of the first instruction
+      bool loadText(const char * text, uint64_t size, std::ostream & out);
+      void loadline(const char * line);
+      int32_t convert (const char * line, int start, int end);
+      bool checkErrors(const char * line, uint64_t length);
+      bool checkComment(const char * line);
+      bool checkColon(const char * line);
+      bool checkPipe(const char * line, uint64_t length);
+      bool checkAddress(const char * line);
+      bool dataSpace(const char * line);
    public:
-      Loader(int argc, char * argv[]);
+      Loader(char * file, Memory * mem, std::ostream & out);
       bool isLoaded();
+      uint64_t getEntry();
 };
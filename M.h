@@ -18,5 +18,5 @@ class M : public PipeReg
       PipeRegField * getvalA();
       PipeRegField * getdstE();
       PipeRegField * getdstM();
-      void dump();
+      void dump(std::ostream & out);
 };
@@ -1,17 +1,74 @@
-
-//size of memory
+//default size of memory
 #define MEMSIZE 0x1000
-class Memory 
+//largest memory that can be simulated (1 TB)
+#define MAXMEMSIZE 0x10000000000
+//number of bytes displayed on one line of a memory dump
+#define LINESIZE 32
+//memory is allocated PAGESIZE bytes at a time
+#define PAGEBITS 12
+#define PAGESIZE (1 << PAGEBITS)
+//each page table holds the pointers to TABLESIZE pages
+#define TABLEBITS 10
+#define TABLESIZE (1 << TABLEBITS)
+//number of pages in each block of pages taken from the system
+#define ARENAPAGES 64
+
+//a page of memory; it is allocated the first time it is written
+struct Page
+{
+   uint8_t bytes[PAGESIZE];
+   bool dirty[PAGESIZE / LINESIZE];   //true if a line was written
+   uint64_t address;                  //address of the first byte
+   Page * nextDirty;                  //next page on the dirty list
+   bool listed;                       //true if on the dirty list
+};
+
+//a block of pages that new pages are handed out from
+struct Arena
+{
+   Page * pages;
+   int32_t used;     //number of pages handed out so far
+   Arena * next;
+};
+
+//Memory is a sparse 64-bit address space of size limit. Pages are only
+//allocated when they are written; reading memory that has never been
+//written returns 0s. Pages are found with a two level page table, but
+//the most recently used page is remembered so that most accesses don't
+//have to walk the table. A shared memory can be read by several
+//threads at once (but not while it is being written).
+class Memory
 {
    private:
-      static Memory * memInstance;
-      Memory();
-      uint8_t mem[MEMSIZE];
+      uint64_t limit;             //addresses must be less than limit
+      Page *** directory;         //page tables, NULL if not allocated
+      uint64_t numTables;         //number of entries in directory
+      Arena * arena;              //most recently allocated arena
+      int32_t arenaSize;          //number of pages in each arena
+      uint64_t lastPageNum;       //page number of lastPage
+      Page * lastPage;            //most recently used page or NULL
+      Page * dirtyList;           //pages written since clearDirty
+      bool shared;                //true if several threads read it at once
+      Page * findPage(uint64_t address, bool allocate);
+      Page * newPage(uint64_t address);
+      void markDirty(Page * page, uint64_t address);
+      void dumpLine(std::ostream & out, uint64_t address);
    public:
-      static Memory * getInstance();      
-      uint64_t getLong(int32_t address, bool & error);
-      uint8_t getByte(int32_t address, bool & error);
-      void putLong(uint64_t value, int32_t address, bool & error);
-      void putByte(uint8_t value, int32_t address, bool & error);
-      void dump();
-}; 
+      Memory(uint64_t limit = MEMSIZE);
+      ~Memory();
+      uint64_t getLimit();
+      void setShared(bool shared);
+      uint64_t getLong(uint64_t address, bool & error);
+      uint8_t getByte(uint64_t address, bool & error);
+      void putLong(uint64_t value, uint64_t address, bool & error);
+      void putByte(uint8_t value, uint64_t address, bool & error);
+      void getBytes(uint64_t address, uint8_t * bytes, uint64_t size,
+                    bool & error);
+      void putBytes(uint64_t address, const uint8_t * bytes, uint64_t size,
+                    bool & error);
+      bool nextPage(uint64_t & address);
+      void dump(std::ostream & out);
+      void dumpDirty(std::ostream & out);
+      bool nextDirty(uint64_t & address);
+      void clearDirty();
+};
@@ -1,16 +1,28 @@
-class MemoryStage: public Stage
+class Memory;
+class DecodeCache;
+class Cache;
+class StoreBuffer;
+class Pipeline;
+
+class MemoryStage
 {
    private:
-      uint64_t stat;
-      uint64_t valM; 
-      void setWInput(W * wreg, uint64_t stat, uint64_t icode, uint64_t valE, 
+      Memory * mem;
+      DecodeCache * icache;
+      Cache * l1d;          //data cache model (NULL if there is none)
+      StoreBuffer * stores; //where stores are held when the memory is
+                            //shared by several cores (NULL if it isn't)
+      void setWInput(WState * wreg, uint64_t stat, uint64_t icode, uint64_t valE, 
                      uint64_t valM, uint64_t dstE, uint64_t dstM);
-      bool mem_read(M * mreg);
-      bool mem_write(M * mreg);
-      uint64_t Addr(M * mreg);
+      bool mem_read(MState * mreg);
+      bool mem_write(MState * mreg);
+      uint64_t Addr(MState * mreg);
+      bool retMispredicted(MState * mreg, uint64_t valM);
+      bool dataReady(MState * mreg);
+      void bubbleW(WState * wreg);
    public:
-      bool doClockLow(PipeReg ** pregs, Stage ** stages);
-      void doClockHigh(PipeReg ** pregs);
-      uint64_t getm_valM();
-      uint64_t getm_stat();
+      MemoryStage(Memory * mem, DecodeCache * icache);
+      void setCache(Cache * l1d);
+      void setStoreBuffer(StoreBuffer * stores);
+      bool doClockLow(Pipeline * pipe);
 };
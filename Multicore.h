@@ -0,0 +1,72 @@
+class Memory;
+class Simulate;
+
+//times a thread checks the barrier before it starts giving up the CPU
+//to the other threads while it waits
+#define BARRIERSPINS 4096
+
+//Stops the threads of a Multicore machine at the end of each quantum.
+//wait returns true to the last thread to arrive, which does the work
+//that has to be done by one thread and then calls release to let the
+//others go on. The quanta are short (one cycle by default) so the
+//threads spin rather than sleep on a lock. They yield the CPU after
+//BARRIERSPINS checks, or at once when there are more threads than
+//CPUs since then the thread being waited for may not be running.
+class Barrier
+{
+   private:
+      int32_t numThreads;
+      uint64_t spins;                     //checks before yielding
+      std::atomic<int32_t> waiting;       //threads stopped at the barrier
+      std::atomic<uint64_t> generation;   //number of times the barrier
+                                          //was released
+   public:
+      Barrier(int32_t numThreads);
+      bool wait();
+      void release();
+};
+
+//Simulates several PIPE cores that share one memory. Each core is its
+//own Simulate object with its own registers, condition codes and
+//pipeline, starting at its own entry point. The cores are stepped on
+//host threads a quantum of cycles at a time. The stores a core makes
+//during a quantum are held in its StoreBuffer (it sees them, the other
+//cores don't) and at the end of the quantum the buffers are written
+//to memory one core after the other, core 0 first. So the cores see
+//each other's stores in the same order however many threads are used
+//and the output doesn't depend on how the threads were scheduled.
+//With a quantum of 1 (the default) a store is seen by the other cores
+//in the next cycle.
+class Multicore
+{
+   private:
+      std::ostream * out;            //where the dumps are written
+      int32_t mode;                  //OUTFULL, OUTSILENT, OUTFINAL or OUTEVERY
+      uint64_t interval;             //cycles between dumps in OUTEVERY mode
+      Memory * mem;                  //shared by the cores
+      std::vector<Simulate *> cores;
+      std::vector<uint8_t> stopped;  //1 for the cores that stopped
+      uint64_t quantum;              //cycles between commits of the stores
+      uint64_t maxCycles;            //cycles after which run stops (0 for no limit)
+      uint64_t cycles;               //number of cycles simulated
+      uint64_t steps;                //cycles in the current quantum
+      bool done;                     //true when run has to stop
+      Barrier * barrier;
+      void worker(int32_t thread, int32_t numThreads);
+      void stepCores(int32_t thread, int32_t numThreads);
+      void nextQuantum();
+      void endQuantum();
+      void commit();
+      void dumpCycle(uint64_t cycle);
+   public:
+      Multicore(std::ostream & out, int32_t mode, uint64_t interval,
+                uint64_t memSize);
+      ~Multicore();
+      bool load(char * file);
+      Simulate * addCore(uint64_t entry);
+      void setQuantum(uint64_t count);
+      void setMaxCycles(uint64_t count);
+      uint64_t getCycles();
+      uint64_t getInstructions();
+      void run(int32_t numThreads);
+};
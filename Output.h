@@ -0,0 +1,19 @@
+//size of the buffer that collects simulator output before it is written
+#define OUTBUFSIZE 0x10000
+
+//buffered writer for the simulator output. Dumps are formatted
+//into a std::ostream that uses an Output object as its buffer so
+//the text is written to the file in large blocks instead of being
+//flushed after every line.
+class Output : public std::streambuf
+{
+   private:
+      FILE * file;               //file the output is written to
+      char buffer[OUTBUFSIZE];   //output not yet written to file
+   protected:
+      int overflow(int c);
+      int sync();
+   public:
+      Output(FILE * file);
+      ~Output();
+};
@@ -1,4 +1,3 @@
-
 //these can be used as indices into an array of PipeReg
 #define FREG 0
 #define DREG 1
@@ -9,17 +8,30 @@
 //number of PipeRegisters
 #define NUMPIPEREGS 5
 
+//largest number of fields in a single pipeline register (E)
+#define MAXFIELDS 10
+
+class PipeRegField;
+
 //base class for the F, D, E, M, W pipeline registers
 class PipeReg
 {
+   private:
+      PipeRegField * fields[MAXFIELDS];  //fields in the order they were added
+      int32_t numFields;
    public:
+      PipeReg();
+      virtual ~PipeReg();
       //dump method is implemented in the classes that descend
       //from PipeReg
       //
       //dump is abstract
       //virtual makes it polymorphic 
-      virtual void dump() = 0;
+      virtual void dump(std::ostream & out) = 0;
+      int32_t getNumFields();
+      PipeRegField * getField(int32_t index);
    protected:
-      void dumpField(std::string label, int width, uint64_t value, bool nl);
+      PipeRegField * addField(PipeRegField * field);
+      void dumpField(std::ostream & out, std::string label, int width,
+                     uint64_t value, bool nl);
 };
-
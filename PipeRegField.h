@@ -10,6 +10,7 @@ class PipeRegField
       PipeRegField(int state = 0); 
       void setInput(uint64_t input);
       uint64_t getOutput();
+      uint64_t getInput();
       void normal();
       void stall();
       void bubble(int state = 0);
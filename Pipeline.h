@@ -0,0 +1,131 @@
+class PipeReg;
+
+//pc field of a register that holds a bubble rather than an instruction;
+//also the predPC of a ret whose target wasn't predicted (fetch stalled)
+#define BUBBLEPC UINT64_MAX
+
+//fields of the F pipelined register
+struct FState
+{
+   uint64_t predPC;
+};
+
+//fields of the D pipelined register
+struct DState
+{
+   uint64_t stat;
+   uint64_t icode;
+   uint64_t ifun;
+   uint64_t rA;
+   uint64_t rB;
+   uint64_t valC;
+   uint64_t valP;
+   uint64_t pc;      //address of the instruction (not dumped)
+   uint64_t predPC;  //address fetched after the instruction (not dumped)
+};
+
+//fields of the E pipelined register
+struct EState
+{
+   uint64_t stat;
+   uint64_t icode;
+   uint64_t ifun;
+   uint64_t valC;
+   uint64_t valA;
+   uint64_t valB;
+   uint64_t dstE;
+   uint64_t dstM;
+   uint64_t srcA;
+   uint64_t srcB;
+   uint64_t pc;      //address of the instruction (not dumped)
+   uint64_t predPC;  //address fetched after the instruction (not dumped)
+};
+
+//fields of the M pipelined register
+struct MState
+{
+   uint64_t stat;
+   uint64_t icode;
+   uint64_t Cnd;
+   uint64_t valE;
+   uint64_t valA;
+   uint64_t dstE;
+   uint64_t dstM;
+   uint64_t ifun;    //function of the instruction (not dumped)
+   uint64_t pc;      //address of the instruction (not dumped)
+   uint64_t predPC;  //address fetched after the instruction (not dumped)
+   uint64_t redirect;   //where fetch has to go if the jump was
+                        //mispredicted, otherwise BUBBLEPC (not dumped)
+};
+
+//fields of the W pipelined register
+struct WState
+{
+   uint64_t stat;
+   uint64_t icode;
+   uint64_t valE;
+   uint64_t valM;
+   uint64_t dstE;
+   uint64_t dstM;
+   uint64_t pc;      //address of the instruction (not dumped)
+   uint64_t predPC;  //address fetched after the instruction (not dumped)
+};
+
+//one copy of all five pipelined registers
+struct PipeState
+{
+   FState F;
+   DState D;
+   EState E;
+   MState M;
+   WState W;
+};
+
+//values computed by one stage and used by an earlier stage in the
+//same cycle (wires rather than pipelined registers), and the control
+//signals and their causes for the cycle
+struct Signals
+{
+   uint64_t d_srcA;
+   uint64_t d_srcB;
+   uint64_t e_Cnd;
+   uint64_t e_dstE;
+   uint64_t e_valE;
+   uint64_t m_stat;
+   uint64_t m_valM;
+   bool loadUse;       //E holds a load of a register that D reads
+   bool mispredict;    //E holds a jump that went the other way
+   bool retMiss;       //M holds a ret whose target was mispredicted
+   bool retHazard;     //D, E or M holds a ret that fetch waits for
+   bool iMiss;         //fetch is waiting for the instruction cache
+   bool dMiss;         //M is waiting for the data cache
+   bool F_stall;
+   bool D_stall;
+   bool D_bubble;
+   bool E_stall;       //same as M_stall
+   bool E_bubble;
+   bool M_stall;       //dMiss
+   bool M_bubble;      //an exception is in M or W or retMiss
+   bool W_bubble;      //same as M_stall
+};
+
+//The pipelined registers of the machine kept in two flat copies.
+//During the low half of the clock the stages read the outputs of the
+//registers (state) and write their inputs (next), copying the output
+//for a stall and the nop values for a bubble. The rising edge of the
+//clock swaps the two copies so the inputs become the new outputs.
+//The F, D, E, M and W classes are only used to dump the registers;
+//load and store copy the fields between them and the pipeline.
+class Pipeline
+{
+   private:
+      PipeState regs[2];
+   public:
+      PipeState * state;     //outputs of the pipelined registers
+      PipeState * next;      //inputs of the pipelined registers
+      Signals sig;
+      Pipeline();
+      void clock();
+      void load(PipeReg ** pregs);
+      void store(PipeReg ** pregs);
+};
@@ -0,0 +1,99 @@
+//log2 of the number of 2-bit counters in the bimodal and gshare tables
+#define PREDICTORBITS 12
+#define PREDICTORSIZE (1 << PREDICTORBITS)
+
+//what a predictor has learned, as it is saved in a checkpoint; the
+//predictors that don't learn leave it zeroed
+struct PredictorState
+{
+   uint8_t counters[PREDICTORSIZE];
+   uint64_t history;
+};
+
+//Predicts the direction of the conditional jumps fetched by the
+//FetchStage. Unconditional jumps and calls always go to their target.
+//update is called with the outcome of every jump when it reaches the
+//M stage (where selectPC sees whether the jump was taken).
+class Predictor
+{
+   public:
+      virtual ~Predictor();
+      //name used on the command line and in the statistics
+      virtual const char * getName() = 0;
+      //true if the jump at pc to target is predicted taken
+      virtual bool predict(uint64_t pc, uint64_t target) = 0;
+      virtual void update(uint64_t pc, bool taken);
+      virtual void getState(PredictorState * state);
+      virtual void setState(PredictorState * state);
+      static Predictor * create(const char * name);
+};
+
+//always predicts taken (the predictor of the PIPE machine)
+class TakenPredictor : public Predictor
+{
+   public:
+      const char * getName();
+      bool predict(uint64_t pc, uint64_t target);
+};
+
+//backward taken, forward not taken
+class BTFNTPredictor : public Predictor
+{
+   public:
+      const char * getName();
+      bool predict(uint64_t pc, uint64_t target);
+};
+
+//table of 2-bit saturating counters indexed by the address of the jump
+class BimodalPredictor : public Predictor
+{
+   private:
+      uint8_t counters[PREDICTORSIZE];
+   public:
+      BimodalPredictor();
+      const char * getName();
+      bool predict(uint64_t pc, uint64_t target);
+      void update(uint64_t pc, bool taken);
+      void getState(PredictorState * state);
+      void setState(PredictorState * state);
+};
+
+//table of 2-bit saturating counters indexed by the address of the jump
+//xored with the directions of the most recently resolved jumps
+class GsharePredictor : public Predictor
+{
+   private:
+      uint8_t counters[PREDICTORSIZE];
+      uint64_t history;
+   public:
+      GsharePredictor();
+      const char * getName();
+      bool predict(uint64_t pc, uint64_t target);
+      void update(uint64_t pc, bool taken);
+      void getState(PredictorState * state);
+      void setState(PredictorState * state);
+};
+
+//Return address stack used to predict the target of a ret. A call
+//pushes its return address when it is fetched and a ret pops it. When
+//the stack is full the oldest address is overwritten. The stack isn't
+//repaired when instructions fetched down a mispredicted path are
+//cancelled; the ret is checked in the M stage so that only costs time.
+class ReturnStack
+{
+   private:
+      uint64_t * entries;
+      uint64_t size;
+      uint64_t top;       //index of the next entry to push
+      uint64_t count;     //number of valid entries
+   public:
+      ReturnStack(uint64_t size);
+      ~ReturnStack();
+      uint64_t getSize();
+      bool isEmpty();
+      uint64_t peek();
+      void push(uint64_t address);
+      void pop();
+      void getState(uint64_t * entries, uint64_t & top, uint64_t & count);
+      void setState(const uint64_t * entries, uint64_t top, uint64_t count);
+};
@@ -20,13 +20,15 @@
 class RegisterFile 
 {
    private:
-      static RegisterFile * regInstance;
-      RegisterFile();
       uint64_t reg[REGSIZE];
+      bool dirty[REGSIZE];   //true if reg[i] changed since clearDirty
    public:
-      static RegisterFile * getInstance();      
+      RegisterFile();
       uint64_t readRegister(int32_t regNumber, bool & error);
       void writeRegister(uint64_t value, int32_t regNumber, 
                         bool & error);
-      void dump();
+      void dump(std::ostream & out);
+      void dumpDirty(std::ostream & out);
+      bool isDirty(int32_t regNumber);
+      void clearDirty();
 }; 
@@ -1,13 +1,105 @@
-//Driver class for the yess simulator
+//output modes used by Simulate::run
+#define OUTFULL 0     //dump the whole machine at the end of every cycle
+#define OUTSILENT 1   //no output
+#define OUTFINAL 2    //dump the whole machine after the last cycle only
+#define OUTEVERY 3    //dump the whole machine every Nth cycle and the last
+#define OUTDELTA 4    //dump only what changed during each cycle
+
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class DecodeCache;
+class Pipeline;
+class FetchStage;
+class DecodeStage;
+class ExecuteStage;
+class MemoryStage;
+class WritebackStage;
+class Stats;
+class Predictor;
+class ReturnStack;
+class Cache;
+class TraceWriter;
+class StoreBuffer;
+
+//Driver class for the yess simulator. Each Simulate object is a
+//complete machine with its own memory, register file, condition
+//codes, pipelined registers and stages, so several can be used
+//at the same time. The stages work on the flat copy of the pipelined
+//registers in the Pipeline; the F, D, E, M and W instances are only
+//brought up to date when they are dumped or checkpointed.
 class Simulate
 {
    private:
-      PipeReg ** pregs;
-      Stage ** stages;
+      Memory * mem;
+      bool ownsMemory;        //false if mem is shared with other cores
+      StoreBuffer * stores;   //stores not made to shared memory yet
+                              //(NULL if the memory isn't shared)
+      RegisterFile * reg;
+      ConditionCodes * cc;
+      DecodeCache * icache;   //instructions predecoded by the FetchStage
+      Predictor * predictor;  //predicts the jumps fetched by the FetchStage
+      ReturnStack * ras;      //predicts the rets (NULL if not used)
+      Cache * l1i;            //instruction cache model (NULL if none)
+      Cache * l1d;            //data cache model (NULL if none)
+      Pipeline * pipe;        //pipelined registers used by the stages
+      PipeReg ** pregs;       //pipelined registers used by the dumps
+      FetchStage * fetchStage;
+      DecodeStage * decodeStage;
+      ExecuteStage * executeStage;
+      MemoryStage * memoryStage;
+      WritebackStage * writebackStage;
+      std::ostream * out;   //where the dumps are written
+      int32_t mode;         //one of the output modes above
+      uint64_t interval;    //cycles between dumps in OUTEVERY mode
+      uint64_t lastState[NUMPIPEREGS][MAXFIELDS];   //used by OUTDELTA
+      uint64_t entry;             //address of the first instruction
+      uint64_t startCycle;        //number of the first cycle run simulates
+      uint64_t maxCycles;         //cycles after which run stops (0 for no limit)
+      uint64_t cycles;            //number of cycles run has simulated
+      uint64_t instructions;      //number of instructions run has retired
+      uint64_t checkpointCycle;   //cycle after which a checkpoint is saved
+      char * checkpointFile;      //NULL if no checkpoint is to be saved
+      Stats * stats;              //NULL if no counters are kept
+      char * statsFile;           //where the counters are written
+      TraceWriter * trace;        //NULL if no trace is written
+      bool interpret;             //true if Functional doesn't translate
+      void dumpCycle(uint64_t cycle);
+      void dumpDelta(uint64_t cycle);
+      void dumpState(uint64_t count);
+      void clearDirty();
+      void init(std::ostream & out, Memory * mem, int32_t mode,
+                uint64_t interval);
    public:
-      Simulate();
+      Simulate(std::ostream & out, int32_t mode = OUTFULL, 
+               uint64_t interval = 1, uint64_t memSize = MEMSIZE);
+      Simulate(std::ostream & out, Memory * shared, int32_t mode,
+               uint64_t interval);
+      ~Simulate();
+      Memory * getMemory();
+      bool load(char * file);
+      bool saveImage(char * file);
+      bool restore(char * file);
+      void setCheckpoint(uint64_t cycle, char * file);
+      bool setPredictor(const char * name, uint64_t rasSize);
+      bool setICache(const char * spec);
+      bool setDCache(const char * spec);
+      void setStats(char * file, uint64_t interval);
+      void setEntry(uint64_t address);
+      void setInterpret(bool interpret);
+      void setMaxCycles(uint64_t count);
+      bool setTrace(char * file);
+      uint64_t getCycles();
+      uint64_t getInstructions();
       void run();
+      bool step();
+      StoreBuffer * getStores();
+      void invalidate(uint64_t address, uint64_t size);
+      void runFunctional();
+      void runSuperscalar(uint64_t width, uint64_t memPorts);
+      bool fastForward(uint64_t count);
       bool doClockLow();
       void doClockHigh();
+      void dumpCore();
       void dumpPipeRegs();
 };
@@ -0,0 +1,71 @@
+class Pipeline;
+class Cache;
+
+//instructions below this address are counted in a table rather than
+//a hash map since that is where nearly all programs are
+#define PCTABLESIZE 0x10000
+
+//counts kept for each instruction address
+struct PCStats
+{
+   uint64_t retired;    //number of times the instruction was retired
+   uint64_t stalls;     //bubbles inserted into the pipeline because of it
+};
+
+//totals at the end of one of the periodic intervals
+struct Interval
+{
+   uint64_t cycles;
+   uint64_t instructions;
+   uint64_t stalls;
+   uint64_t mispredicts;
+};
+
+//Performance counters for the PIPE machine. sample is called once per
+//cycle after the stages have computed their control signals; it counts
+//the retired instructions and the stalls and bubbles by cause, and
+//charges each bubble to the instruction that caused it. The counters
+//are written out in JSON along with the accuracy of the jump and ret
+//predictions.
+class Stats
+{
+   private:
+      uint64_t cycles;
+      uint64_t instructions;       //instructions that reached W
+      uint64_t fStallLoadUse;      //F stalled for a load/use hazard
+      uint64_t fStallRet;          //F stalled for a ret
+      uint64_t fStallDCache;       //F stalled for a data cache miss
+      uint64_t dStallLoadUse;      //D stalled for a load/use hazard
+      uint64_t dStallDCache;       //D stalled for a data cache miss
+      uint64_t dBubbleMispredict;  //D bubbled for a mispredicted jump
+      uint64_t dBubbleRet;         //D bubbled for a ret
+      uint64_t dBubbleICache;      //D bubbled for an instruction cache miss
+      uint64_t eBubbleMispredict;  //E bubbled for a mispredicted jump
+      uint64_t eBubbleLoadUse;     //E bubbled for a load/use hazard
+      uint64_t eBubbleRet;         //E bubbled for a mispredicted ret
+      uint64_t mBubble;            //M bubbled for an exception
+      uint64_t mBubbleRet;         //M bubbled for a mispredicted ret
+      uint64_t dCacheWait;         //E and M stalled and W bubbled for a
+                                   //data cache miss
+      uint64_t jumps;              //jumps executed
+      uint64_t condJumps;          //conditional jumps executed
+      uint64_t notTaken;           //jumps that weren't taken
+      uint64_t mispredicts;        //jumps predicted the wrong way
+      uint64_t rets;               //rets executed
+      uint64_t waitedRets;         //rets that fetch stalled for
+      uint64_t retMisses;          //rets predicted with the wrong target
+      uint64_t interval;           //cycles between snapshots (0 for none)
+      PCStats * table;             //counts for pcs below PCTABLESIZE
+      std::unordered_map<uint64_t, PCStats> pcs;   //counts for the rest
+      std::vector<Interval> intervals;
+      PCStats & counts(uint64_t pc);
+      void charge(uint64_t pc);
+      void snapshot(Interval & totals);
+      void writeInterval(std::ostream & out, Interval & start, Interval & end);
+   public:
+      Stats(uint64_t interval);
+      ~Stats();
+      void sample(Pipeline * pipe);
+      void write(std::ostream & out, const char * predictor, 
+                 uint64_t rasSize, Cache * l1i, Cache * l1d);
+};
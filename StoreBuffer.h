@@ -0,0 +1,40 @@
+class Memory;
+
+//a buffer with up to this many words is searched rather than indexed,
+//which is faster for the few stores of a short quantum
+#define SCANSTORES 8
+
+//a store that hasn't been made to the shared memory yet
+struct PendingStore
+{
+   uint64_t address;   //of an aligned 8-byte word
+   uint64_t value;
+};
+
+//Stores made by one core of a Multicore machine during a quantum.
+//They are held here rather than written to the shared memory so that
+//the cores can run at the same time; the core itself reads them back
+//(load forwards the value of a store to a later load and getByte
+//overlays them on the bytes fetched) while the other cores only see
+//them once commit writes them at the end of the quantum. Only the
+//last value stored to each word is kept since that is all the memory
+//ends up with, and once there are more than SCANSTORES words they are
+//indexed so that a load or fetch doesn't depend on how many stores a
+//long quantum has made.
+class StoreBuffer
+{
+   private:
+      std::vector<PendingStore> stores;   //one per word, in the order
+                                          //the words were first stored to
+      std::unordered_map<uint64_t, uint64_t> index;   //address to position
+                                                      //in stores (empty
+                                                      //until it is needed)
+      bool find(uint64_t address, uint64_t & position);
+   public:
+      void add(uint64_t address, uint64_t value);
+      bool load(uint64_t address, uint64_t & value);
+      uint8_t getByte(uint64_t address, uint8_t byte);
+      uint64_t getSize();
+      uint64_t getAddress(uint64_t index);
+      void commit(Memory * mem);
+};
@@ -0,0 +1,103 @@
+class Predictor;
+class ReturnStack;
+class FetchStage;
+class DecodeCache;
+struct Predecoded;
+
+//widest machine that can be modeled
+#define MAXWIDTH 8
+
+//why an instruction didn't issue in the same cycle as the one before
+//it; when there are several reasons the first one listed is counted
+#define SPLITWIDTH 0       //the cycle already issued width instructions
+#define SPLITFETCH 1       //it hadn't been fetched (redirect, fetch width)
+#define SPLITLOADUSE 2     //it uses the result of a load
+#define SPLITDEPEND 3      //it uses a register set in the same cycle
+#define SPLITCC 4          //it tests condition codes set in the same cycle
+#define SPLITMEMPORT 5     //all of the memory ports were in use
+#define SPLITBRANCH 6      //a jump, call or ret issued in the same cycle
+#define NUMSPLITS 7
+
+//a jump whose outcome the predictor learns when the jump reaches M
+struct PendingUpdate
+{
+   uint64_t cycle;   //cycle the jump is in M
+   uint64_t pc;
+   bool taken;
+};
+
+//Timing model of an in-order PIPE machine that fetches, decodes,
+//executes and retires up to width instructions per cycle. It is fed
+//the instructions executed by Functional in program order and works
+//out the cycle each one is fetched and issued from D to E using the
+//rules of the PIPE machine:
+//   - fetch gets up to width instructions per cycle and stops at a
+//     jump, call or ret that is predicted to go somewhere other than
+//     the next instruction; it gets no further than D can hold
+//   - a mispredicted jump restarts fetch when it reaches M, a ret
+//     without a return address stack when it reaches W and a ret the
+//     stack mispredicted when it reaches M; the calls and rets fetched
+//     down the wrong path until then push and pop the return address
+//     stack just as they do in the PIPE machine
+//   - D issues in program order; results are forwarded from E, M and W
+//     but not between instructions in D, so an instruction that uses a
+//     register set by one issued in the same cycle waits a cycle, and
+//     one that uses a loaded register issues two cycles after the load
+//   - a jump or cmov waits a cycle for an OPq issued in the same cycle
+//   - at most memPorts instructions that read or write memory and one
+//     jump, call or ret issue per cycle
+//The program stops at the end of the cycle its last instruction is in
+//W, three cycles after it issues. With a width of 1 the cycles are exactly
+//those simulated by the PIPE machine without caches, so the numbers
+//for wider machines measure how much parallelism there is in a
+//program beyond the CPI of 1 the scalar machine is limited to.
+class Superscalar
+{
+   private:
+      uint64_t width;                 //instructions per cycle
+      uint64_t memPorts;              //memory accesses per cycle
+      Predictor * predictor;
+      ReturnStack * ras;              //NULL if rets aren't predicted
+      FetchStage * fetch;             //decodes the wrong path
+      DecodeCache * icache;
+      std::deque<PendingUpdate> updates;   //jumps not in M yet
+      uint64_t count;                 //instructions so far
+      uint64_t fetched[MAXWIDTH];     //fetch cycles of the last width
+      uint64_t issued[MAXWIDTH];      //issue cycles of the last width
+      uint64_t memIssued[MAXWIDTH];   //issue cycles of the last memPorts
+                                      //memory instructions
+      uint64_t memCount;              //memory instructions so far
+      uint64_t branchReady;           //first cycle a jump, call or ret
+                                      //can issue
+      uint64_t nextFetch;             //earliest cycle of the next fetch
+      uint64_t lastFetch;             //fetch cycle of the last instruction
+      uint64_t fetchSize;             //instructions fetched in lastFetch
+      uint64_t ready[REGSIZE];        //first cycle D can issue an
+                                      //instruction that reads a register
+      bool loaded[REGSIZE];           //true if the register was last
+                                      //set by a load
+      uint64_t ccReady;               //same as ready, for the condition codes
+      uint64_t lastIssue;             //issue cycle of the last instruction
+      uint64_t groupSize;             //instructions issued in lastIssue
+      uint64_t groups[MAXWIDTH + 1];  //cycles that issued 1..width
+      uint64_t splits[NUMSPLITS];     //counts of the reasons for a split
+      uint64_t paired;                //issued with the instruction before
+      uint64_t jumps;                 //conditional jumps
+      uint64_t mispredicts;
+      uint64_t rets;
+      uint64_t waitedRets;            //rets that fetch waited for
+      uint64_t retMisses;             //rets that were mispredicted
+      uint64_t cycles;                //set by finish
+      void learn(uint64_t cycle);
+      void wrongPath(uint64_t pc, uint64_t left, uint64_t cycles);
+      void setReady(Predecoded * instr, uint64_t cycle);
+      bool accessesMemory(uint64_t icode);
+   public:
+      Superscalar(uint64_t width, uint64_t memPorts, Predictor * predictor,
+                  ReturnStack * ras, FetchStage * fetch, DecodeCache * icache);
+      void add(uint64_t pc, Predecoded * instr, uint64_t next, bool taken);
+      void finish();
+      uint64_t getCycles();
+      void write(std::ostream & out, const char * predictorName,
+                 uint64_t rasSize);
+};
@@ -0,0 +1,98 @@
+//first bytes of every trace file
+#define TRACEMAGIC "Y86TRC"
+//changes whenever the layout of a trace file changes
+#define TRACEVERSION 1
+
+//kinds of entries in the record of a cycle
+#define TRACEEND 0     //end of the record
+#define TRACEFIELD 1   //dumped field of a pipelined register: index, value
+#define TRACEREG 2     //register: number, value
+#define TRACECC 3      //condition codes: ZF, SF and OF in bits 0 to 2
+#define TRACEMEM 4     //line of memory: address, LINESIZE / 8 words
+
+//number of fields of the pipelined registers that are dumped
+#define TRACEFIELDS 31
+
+//bytes of the trace collected before they are written to the file
+#define TRACEBUFSIZE 0x10000
+
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class PipeReg;
+class Pipeline;
+struct PipeState;
+
+//Layout of the start of a trace file. It is followed by one record for
+//the state of the machine before firstCycle and then one record for
+//each cycle simulated. A record is a list of entries for the parts of
+//the machine that changed, each one a kind byte followed by varints,
+//ending with a TRACEEND byte. The first record holds the changes from
+//a machine whose fields, registers, condition codes and memory are all
+//0. The values of fields and registers are stored xored with their
+//previous value so that small changes take few bytes.
+struct TraceHeader
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t unused;
+   uint64_t memSize;       //memory limit
+   uint64_t firstCycle;    //number of the first cycle traced
+};
+
+//Writes the trace of a run as it is simulated. start is called before
+//the first cycle and cycle after each one; both use the dirty flags
+//of the register file, condition codes and memory, which the caller
+//has to clear after each call.
+class TraceWriter
+{
+   private:
+      std::ofstream out;
+      char buffer[TRACEBUFSIZE];    //bytes not written to out yet
+      uint64_t used;                //number of bytes in buffer
+      uint64_t last[TRACEFIELDS];   //fields written so far
+      uint64_t lastReg[REGSIZE];    //registers written so far
+      void put(uint64_t byte);
+      void flush();
+      void putVarint(uint64_t value);
+      void putFields(PipeState * state);
+      void putLine(Memory * mem, uint64_t address);
+   public:
+      TraceWriter(char * file);
+      bool isOpen();
+      void start(uint64_t cycle, PipeState * state, RegisterFile * reg,
+                 ConditionCodes * cc, Memory * mem);
+      void cycle(PipeState * state, RegisterFile * reg,
+                 ConditionCodes * cc, Memory * mem);
+      bool close();
+};
+
+//Replays a trace file one cycle at a time on a machine of its own so
+//that the state at the end of any cycle can be dumped or compared.
+//The lines of memory changed by the last cycle are kept so that two
+//traces can be compared without looking at all of memory.
+class TraceReader
+{
+   private:
+      std::ifstream in;
+      bool valid;             //false if the file isn't a trace
+      uint64_t firstCycle;    //number of the first cycle traced
+      uint64_t count;         //number of cycles replayed
+      uint64_t fields[TRACEFIELDS];
+      Memory * mem;
+      RegisterFile * reg;
+      ConditionCodes * cc;
+      Pipeline * pipe;
+      PipeReg ** pregs;
+      std::vector<uint64_t> lines;  //lines changed by the last cycle
+      bool getVarint(uint64_t & value);
+      bool readRecord();
+   public:
+      TraceReader(char * file);
+      ~TraceReader();
+      bool isValid();
+      bool next();
+      uint64_t getCycle();
+      void dump(std::ostream & out);
+      std::string compare(TraceReader * other);
+};
@@ -16,5 +16,5 @@ class W : public PipeReg
       PipeRegField * getvalM();
       PipeRegField * getdstE();
       PipeRegField * getdstM();
-      void dump();
+      void dump(std::ostream & out);
 };
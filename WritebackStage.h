@@ -1,9 +1,11 @@
-class WritebackStage: public Stage
+class RegisterFile;
+class Pipeline;
+
+class WritebackStage
 {
    private:
-
+      RegisterFile * reg;
    public:
-      bool doClockLow(PipeReg ** pregs, Stage ** stages);
-      void doClockHigh(PipeReg ** pregs);
-
-};
\ No newline at end of file
+      WritebackStage(RegisterFile * reg);
+      bool doClockLow(Pipeline * pipe);
+};
@@ -0,0 +1,127 @@
+#!/bin/bash
+#
+# Measures the throughput of yess on a fixed set of programs and
+# compares it to the numbers in Bench/baseline.csv.
+# Usage: bench.sh [--update]
+#
+# Each program is run with --silent and with a dump after every cycle
+# (written to /dev/null and limited to DUMPCYCLES cycles since the
+# dumps are much slower). Every run is repeated REPEAT times and the
+# fastest one is kept. The results go to Bench/results.csv:
+#    program,mode,cycles,instructions,load_s,run_s,cycles_per_s,
+#    instructions_per_s,maxrss_kb
+#
+# A run is a regression if its cycles or instructions per second are
+# more than THRESHOLD percent below the baseline or its peak resident
+# set size is more than THRESHOLD percent above it. Times under MINTIME
+# seconds are too short to be compared. Different cycle or instruction
+# counts mean that the simulator doesn't do the same work anymore and
+# the baseline has to be made again. --update replaces the baseline
+# with the results.
+#
+# The exit status is 1 if there is a regression or a difference.
+
+REPEAT=${REPEAT:-5}
+THRESHOLD=${THRESHOLD:-10}
+MINTIME=${MINTIME:-0.05}
+DUMPCYCLES=${DUMPCYCLES:-20000}
+baseline="Bench/baseline.csv"
+results="Bench/results.csv"
+
+#the programs of Tests that load; the others there are only run by
+#run.sh to test options
+programs=( Tests/nop.yo Tests/selfmod.yo fibo.yo Bench/*.yo )
+modes=( silent dumps )
+
+if [ ! -x ./yess ]; then
+   echo "yess has not been built"
+   exit 1
+fi
+
+#run <program> <mode>
+#prints the bench line of the fastest of REPEAT runs
+run()
+{
+   local options
+   if [ "$2" == "silent" ]; then
+      options="--silent"
+   else
+      options="--max-cycles $DUMPCYCLES"
+   fi
+   for ((i = 0; i < $REPEAT; i++))
+   do
+      ./yess $1 $options --bench 2>&1 > /dev/null | grep "^bench:"
+   done | sort -g -k 5 | head -1
+}
+
+echo "program,mode,cycles,instructions,load_s,run_s,cycles_per_s,instructions_per_s,maxrss_kb" > $results
+for program in ${programs[@]}
+do
+   for mode in ${modes[@]}
+   do
+      line=$(run $program $mode)
+      if [ "$line" == "" ]; then
+         echo "$program does not load; skipped"
+         break
+      fi
+      echo "$line" | awk -v program=$program -v mode=$mode '{
+         run = $5 > 0 ? $5 : 1e-9
+         printf "%s,%s,%d,%d,%.6f,%.6f,%.0f,%.0f,%d\n", program, mode,
+                $7, $9, $3, $5, $7 / run, $9 / run, $11
+      }' >> $results
+   done
+done
+
+if [ "$1" == "--update" ]; then
+   cp $results $baseline
+   echo "Baseline saved in $baseline"
+   exit 0
+fi
+
+if [ ! -e $baseline ]; then
+   cat $results
+   echo "No baseline; run make bench-baseline to save one"
+   exit 1
+fi
+
+#compare each result to the line of the baseline for the same program
+#and mode, then print the totals for each mode
+awk -F, -v threshold=$THRESHOLD -v mintime=$MINTIME '
+   FNR == 1 { next }
+   NR == FNR { base[$1 "," $2] = $0; next }
+   {
+      key = $1 "," $2
+      total[$2] += $6; cycles[$2] += $3
+      if (!(key in base)) { print "new      " key; next }
+      split(base[key], b, ",")
+      btotal[$2] += b[6]; bcycles[$2] += b[3]
+      status = "ok"
+      if ($3 != b[3] || $4 != b[4]) {
+         status = "DIFFERS"
+         detail = sprintf("cycles %d instructions %d, baseline %d %d",
+                          $3, $4, b[3], b[4])
+      } else {
+         detail = sprintf("%.2f Mcycles/s (%+.1f%%) %d KB (%+.1f%%)",
+                          $7 / 1e6, (b[7] > 0 ? 100 * ($7 - b[7]) / b[7] : 0),
+                          $9, 100 * ($9 - b[9]) / b[9])
+         if (b[6] >= mintime && $6 >= mintime &&
+             ($7 < b[7] * (1 - threshold / 100) ||
+              $8 < b[8] * (1 - threshold / 100)))
+            status = "SLOWER"
+         if ($9 > b[9] * (1 + threshold / 100)) status = "BIGGER"
+      }
+      if (status != "ok") failed++
+      printf "%-8s %-24s %-7s %s\n", status, $1, $2, detail
+   }
+   END {
+      for (mode in total)
+         if (total[mode] > 0 && btotal[mode] > 0)
+            printf "total    %-32s %.3f s %.2f Mcycles/s, baseline %.3f s %.2f Mcycles/s\n",
+                   mode, total[mode], cycles[mode] / total[mode] / 1e6,
+                   btotal[mode], bcycles[mode] / btotal[mode] / 1e6
+      if (failed > 0) {
+         printf "%d regressions or differences (threshold %d%%)\n", failed, threshold
+         exit 1
+      }
+      print "No regressions (threshold " threshold "%)"
+   }' $baseline $results
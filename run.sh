@@ -20,30 +20,116 @@ tests=( error1 error2 error3 error4 error5 error6
 numTests=0
 numPasses=0
 
-for atest in ${tests[@]}
-do
-   infile="$dir/$atest.yo"
-   studoutfile="$atest.sdump"
-   instoutfile="$dir/$atest.idump"
-   rm -f $studoutfile
-   ./yess $infile > $studoutfile
+#runs a test: the output of the command is compared to the correct
+#output file
+#$1 - input file
+#$2 - correct output file
+#$3 - output file of the command
+#$4 - command
+compare()
+{
+   rm -f $3
+   eval "$4" > $3
    rm -f diffs
-   diff $instoutfile $studoutfile > diffs
-   if [ ! -e $studoutfile ] ||  [ ! -s $studoutfile ] || [ -s diffs ]; then
-      cp $instoutfile Outputs/
-      cp $infile Outputs/
-      mv $studoutfile Outputs/
-      echo "Testing $infile ... failed"
+   diff $2 $3 > diffs
+   if [ ! -e $3 ] ||  [ ! -s $3 ] || [ -s diffs ]; then
+      cp $2 Outputs/
+      cp $1 Outputs/
+      mv $3 Outputs/
+      echo "Testing $4 ... failed"
       cat diffs
       rm -f diffs
    else
       rm -f diffs
-      rm -f $studoutfile
-      echo "Testing $infile ... passed"
+      rm -f $3
+      echo "Testing $4 ... passed"
       numPasses=$(($numPasses+1))
    fi
    numTests=$(($numTests+1))
+}
+
+for atest in ${tests[@]}
+do
+   compare $dir/$atest.yo $dir/$atest.idump $atest.sdump "./yess $dir/$atest.yo"
 done
+
+#tests of the options, run on the programs in the local Tests directory.
+#Each one is the name of the correct output (Tests/<name>.idump, where
+#the name starts with the name of the program or of the --batch list)
+#followed by the commands whose output is compared to it.
+opts="--predictor gshare --ras 4 --icache 64:2:16:lru:3 --dcache 64:2:16:fifo:5"
+#the condition codes, registers and memory at the end of a dump
+state="sed -n '/^ZF/,\$p'"
+opttests=(
+   "calls ./yess Tests/calls.yo"
+   "calls-delta ./yess Tests/calls.yo --delta"
+   "calls-final ./yess Tests/calls.yo --final"
+   "calls-every ./yess Tests/calls.yo --every 25"
+   "calls-memsize ./yess Tests/calls.yo --final --mem-size 0x4000"
+   "calls ./yess Tests/calls.yo --checkpoint-at 100 calls.ckpt --max-cycles 101; \
+          ./yess --restore calls.ckpt"
+   "calls-stats ./yess Tests/calls.yo $opts --silent --stats calls.json \
+                --stats-interval 100; cat calls.json"
+   "calls-caches ./yess Tests/calls.yo $opts --every 10"
+   "calls-caches ./yess Tests/calls.yo $opts --every 10 \
+                 --checkpoint-at 100 calls.ckpt --max-cycles 101; \
+                 ./yess --restore calls.ckpt $opts --every 10"
+   "calls-restore ./yess Tests/calls.yo --checkpoint-at 100 calls.ckpt --silent; \
+                  ./yess --restore calls.ckpt --functional; \
+                  ./yess --restore calls.ckpt --fast-forward 5 --final"
+   "calls ./yess Tests/calls.yo --compile-image calls.ybin; ./yess calls.ybin"
+   "calls ./yess Tests/calls.yo --trace calls.ytrc --silent; \
+          ./ytrace show calls.ytrc"
+   "calls-trace ./yess Tests/calls.yo --trace calls.ytrc --silent; \
+                ./yess Tests/calls.yo --dcache 64:2:16:lru:3 \
+                --trace calls-dcache.ytrc --silent; \
+                ./ytrace compare calls.ytrc Tests/calls.idump; \
+                ./ytrace compare calls.ytrc calls.ytrc; \
+                ./ytrace compare calls.ytrc calls-dcache.ytrc"
+   "calls-functional ./yess Tests/calls.yo --functional"
+   "calls-functional ./yess Tests/calls.yo --functional --interpret"
+   "calls-state ./yess Tests/calls.yo --final | $state"
+   "calls-state ./yess Tests/calls.yo --functional | $state"
+   "calls-state ./yess Tests/calls.yo --fast-forward 20 --final | $state"
+   "calls-state ./yess Tests/calls.yo --fast-forward 20 --interpret --final | \
+               $state"
+   "selfmod-functional ./yess Tests/selfmod.yo --functional"
+   "selfmod-functional ./yess Tests/selfmod.yo --functional --interpret"
+   "selfmod-state ./yess Tests/selfmod.yo --final | $state"
+   "selfmod-state ./yess Tests/selfmod.yo --functional | $state"
+   "selfmod-state ./yess Tests/selfmod.yo --fast-forward 20 --final | $state"
+   "selfmod-state ./yess Tests/selfmod.yo --fast-forward 20 --interpret --final | \
+                 $state"
+   "calls-cycles ./yess Tests/calls.yo --silent --stats calls.json; \
+              grep '\"cycles\"' calls.json"
+   "calls-cycles ./yess Tests/calls.yo --width 1 --silent --stats calls.json; \
+              grep '\"cycles\"' calls.json"
+   "selfmod-cycles ./yess Tests/selfmod.yo --silent --stats selfmod.json; \
+                grep '\"cycles\"' selfmod.json"
+   "selfmod-cycles ./yess Tests/selfmod.yo --width 1 --silent --stats selfmod.json; \
+                grep '\"cycles\"' selfmod.json"
+   "calls-width ./yess Tests/calls.yo --width 2 --stats calls.json; \
+                cat calls.json"
+   "batch ./yess --batch Tests/batch.list -j 1"
+   "batch ./yess --batch Tests/batch.list -j 2"
+   "batch ./yess --batch Tests/batch.list -j 4"
+   "cores ./yess Tests/cores.yo --core 0 --core 0x100 --every 10 -j 1"
+   "cores ./yess Tests/cores.yo --core 0 --core 0x100 --every 10 -j 2"
+   "cores-quantum ./yess Tests/cores.yo --core 0 --core 0x100 --quantum 4 \
+                  --final -j 1"
+   "cores-quantum ./yess Tests/cores.yo --core 0 --core 0x100 --quantum 4 \
+                  --final -j 2"
+)
+
+for atest in "${opttests[@]}"
+do
+   name=${atest%% *}
+   input=Tests/${name%%-*}.yo
+   if [ ! -e $input ]; then input=Tests/${name%%-*}.list; fi
+   compare $input Tests/$name.idump $name.sdump "${atest#* }"
+done
+rm -f fibo.sdump calls.json selfmod.json calls.ckpt calls.ybin calls.ytrc calls-dcache.ytrc
+
 echo " "
 echo "$numPasses passed out of $numTests tests."
 